@@ -12,9 +12,12 @@ NS_ASSUME_NONNULL_BEGIN
 
 @interface TapFloatingCell : UIView
 @property (nonatomic, strong) UIImageView *itemIcon;
-@property (nonatomic, strong) UILabel *itemTitle;
+@property (nonatomic, strong) UIImageView *itemTitle;
+@property (nonatomic, assign) BOOL titleNeedsReload;
 
 - (void)setupWithComponent:(TapSDKSuiteComponent *)component;
+
+- (void)reloadTitle;
 @end
 
 NS_ASSUME_NONNULL_END
@@ -8,9 +8,12 @@
 #import "TapFloatingCell.h"
 #import "TapSDKSuite.h"
 #import "TapSDKSuiteUtils.h"
+#import "TapSDKSuiteTextCache.h"
 
 @interface TapFloatingCell ()
 @property (nonatomic, strong) TapSDKSuiteComponent *component;
+// 当前标题位图对应的可用宽度
+@property (nonatomic, assign) CGFloat titleWidth;
 @end
 
 @implementation TapFloatingCell
@@ -51,7 +54,25 @@
 - (void)setupWithComponent:(TapSDKSuiteComponent *)component {
     self.component = component;
     self.itemIcon.image = component.icon;
-    self.itemTitle.text = component.title;
+    [self reloadTitle];
+}
+
+- (void)layoutSubviews {
+    [super layoutSubviews];
+    // 可用宽度随入口在弧线上的位置变化，布局确定或变化后按新宽度重新截断
+    if (CGRectGetWidth(self.itemTitle.bounds) != self.titleWidth) {
+        [self reloadTitle];
+    }
+}
+
+- (void)reloadTitle {
+    // 标题使用共享的文字位图，重复打开菜单不会重新排版和光栅化
+    // 布局前宽度为 0 时不生成位图，由 layoutSubviews 补上
+    NSString *title = self.component.title;
+    self.titleWidth = CGRectGetWidth(self.itemTitle.bounds);
+    self.itemTitle.image = [TapSDKSuiteTextCache imageWithText:title font:[UIFont systemFontOfSize:10] color:[UIColor whiteColor] maxWidth:self.titleWidth];
+    self.itemTitle.accessibilityLabel = title;
+    self.titleNeedsReload = NO;
 }
 
 - (UIImageView *)itemIcon {
@@ -61,13 +82,13 @@
     return _itemIcon;
 }
 
-- (UILabel *)itemTitle {
+- (UIImageView *)itemTitle {
     if (!_itemTitle) {
-        _itemTitle = [UILabel new];
-        _itemTitle.textColor = [UIColor whiteColor];
-        _itemTitle.font = [UIFont systemFontOfSize:10];
-        _itemTitle.baselineAdjustment = UIBaselineAdjustmentAlignCenters;
-        _itemTitle.numberOfLines = 1;
+        _itemTitle = [UIImageView new];
+        _itemTitle.contentMode = UIViewContentModeLeft;
+        _itemTitle.clipsToBounds = YES;
+        _itemTitle.isAccessibilityElement = YES;
+        _itemTitle.accessibilityTraits = UIAccessibilityTraitStaticText;
     }
     return _itemTitle;
 }
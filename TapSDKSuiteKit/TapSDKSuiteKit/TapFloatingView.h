@@ -12,6 +12,9 @@ NS_ASSUME_NONNULL_BEGIN
 @interface TapFloatingView : UIView
 - (void)setupData;
 - (void)showWithAnimation;
+- (void)reloadTitles;
+/// 视图层级中引用的位图，按对象去重
+- (NSHashTable<UIImage *> *)referencedImages;
 @end
 
 NS_ASSUME_NONNULL_END
@@ -7,8 +7,9 @@
 
 #import "TapFloatingView.h"
 #import "TapFloatingCell.h"
-#import "TapSDKSuiteUtils.h"
+#import "TapSDKSuiteUtils+Internal.h"
 #import "TapSDKSuite.h"
+#import "TapSDKSuiteFrameMonitor.h"
 
 @interface TapFloatingView ()<UIScrollViewDelegate>
 @property (nonatomic, strong) UIButton *logoButton;
@@ -17,9 +18,13 @@
 @property (nonatomic, strong) UIView *contentView;
 @property (nonatomic, strong) UIView *bottomProgressView;
 @property (nonatomic, strong) UIView *topProgressView;
+// 当前动画的帧监控，每次展开或收起新建一个
+@property (nonatomic, strong) TapSDKSuiteFrameMonitor *frameMonitor;
 
 @property (nonatomic, strong) NSMutableArray *itemArray;
 @property (nonatomic, strong) NSMutableArray *constraintArray;
+@property (nonatomic, strong) NSMutableArray *dataConstraintArray;
+@property (nonatomic, strong) CAShapeLayer *progressLayer;
 
 @end
 
@@ -77,24 +82,40 @@
 }
 
 - (void)setupData {
+    // 配置变化时会在展示中重建，先移除上一次创建的入口、约束和进度条
+    [self.scrollView setContentOffset:CGPointZero animated:NO];
+    self.topProgressView.transform = CGAffineTransformIdentity;
+    [self.itemArray makeObjectsPerformSelector:@selector(removeFromSuperview)];
+    if (self.dataConstraintArray) {
+        [NSLayoutConstraint deactivateConstraints:self.dataConstraintArray];
+    }
+    [self.progressLayer removeFromSuperlayer];
+
     NSArray <TapSDKSuiteComponent *> *data = [TapSDKSuiteUtils currentConfig];
     NSInteger count = data.count;
     self.constraintArray = [NSMutableArray array];
+    self.dataConstraintArray = [NSMutableArray array];
     self.itemArray = [NSMutableArray array];
 
-    if ([TapSDKSuiteUtils currentConfig].count < 6) {
+    NSLayoutConstraint *contentConstraint;
+    if (count < 6) {
         self.bottomProgressView.hidden = YES;
-        [[NSLayoutConstraint constraintWithItem:self.contentView attribute:NSLayoutAttributeCenterY relatedBy:NSLayoutRelationEqual toItem:self.scrollView attribute:NSLayoutAttributeCenterY multiplier:1.0 constant:0] setActive:YES];
+        contentConstraint = [NSLayoutConstraint constraintWithItem:self.contentView attribute:NSLayoutAttributeCenterY relatedBy:NSLayoutRelationEqual toItem:self.scrollView attribute:NSLayoutAttributeCenterY multiplier:1.0 constant:0];
     } else {
-        [[NSLayoutConstraint constraintWithItem:self.contentView attribute:NSLayoutAttributeTop relatedBy:NSLayoutRelationEqual toItem:self.scrollView attribute:NSLayoutAttributeTop multiplier:1.0 constant:0] setActive:YES];
+        self.bottomProgressView.hidden = NO;
+        contentConstraint = [NSLayoutConstraint constraintWithItem:self.contentView attribute:NSLayoutAttributeTop relatedBy:NSLayoutRelationEqual toItem:self.scrollView attribute:NSLayoutAttributeTop multiplier:1.0 constant:0];
     }
+    [contentConstraint setActive:YES];
+    [self.dataConstraintArray addObject:contentConstraint];
 
     CGFloat contentHeight = 64 * count;
     CGFloat topMargin = ([TapSDKSuiteUtils screenShortLength]  - 64 * 5) / 2;
     if (count >= 6) {
         contentHeight += (topMargin + 32);
     }
-    [[NSLayoutConstraint constraintWithItem:self.contentView attribute:NSLayoutAttributeHeight relatedBy:NSLayoutRelationEqual toItem:nil attribute:NSLayoutAttributeHeight multiplier:1.0 constant:contentHeight] setActive:YES];
+    NSLayoutConstraint *heightConstraint = [NSLayoutConstraint constraintWithItem:self.contentView attribute:NSLayoutAttributeHeight relatedBy:NSLayoutRelationEqual toItem:nil attribute:NSLayoutAttributeHeight multiplier:1.0 constant:contentHeight];
+    [heightConstraint setActive:YES];
+    [self.dataConstraintArray addObject:heightConstraint];
 
     self.scrollView.contentSize = CGSizeMake(250, contentHeight);
 
@@ -148,6 +169,7 @@
     bgLayer.path = circlePath.CGPath;
 
     [self.topProgressView.layer addSublayer:bgLayer];
+    self.progressLayer = bgLayer;
 }
 
 - (CGFloat)getXFromY:(CGFloat)offsetY {
@@ -158,8 +180,48 @@
     return realX + 53 - 20;
 }
 
+- (void)reloadTitles {
+    // 只刷新当前可见的入口，其余入口滚动进入可见区域时再刷新
+    for (TapFloatingCell *cell in self.itemArray) {
+        if ([self isCellVisible:cell]) {
+            [cell reloadTitle];
+        } else {
+            cell.titleNeedsReload = YES;
+        }
+    }
+}
+
+- (NSHashTable<UIImage *> *)referencedImages {
+    // 入口之间共享同一份位图，按对象去重
+    NSHashTable<UIImage *> *images = [NSHashTable hashTableWithOptions:NSPointerFunctionsObjectPointerPersonality];
+    NSMutableArray *views = [NSMutableArray array];
+    if (self.logoButton.imageView) {
+        [views addObject:self.logoButton.imageView];
+    }
+    for (TapFloatingCell *cell in self.itemArray) {
+        [views addObject:cell.itemIcon];
+        [views addObject:cell.itemTitle];
+    }
+    for (UIImageView *view in views) {
+        if (view.image) {
+            [images addObject:view.image];
+        }
+    }
+    return images;
+}
+
+- (BOOL)isCellVisible:(TapFloatingCell *)cell {
+    return CGRectIntersectsRect(self.scrollView.bounds, [cell convertRect:cell.bounds toView:self.scrollView]);
+}
+
 - (void)scrollViewDidScroll:(UIScrollView *)scrollView {
-    NSInteger count = [TapSDKSuiteUtils currentConfig].count;
+    for (TapFloatingCell *cell in self.itemArray) {
+        if (cell.titleNeedsReload && [self isCellVisible:cell]) {
+            [cell reloadTitle];
+        }
+    }
+
+    NSInteger count = self.itemArray.count;
     if (count < 6) {
         return;
     }
@@ -182,6 +244,12 @@
 
 - (void)showWithAnimation {
     self.hidden = NO;
+    self.alpha = 1;
+    TapSDKSuiteFrameMonitor *monitor = [self startFrameMonitor];
+    if ([TapSDKSuiteUtils shouldReduceAnimation]) {
+        [self showWithCrossFade:monitor];
+        return;
+    }
     self.backgroundColor = [UIColor clearColor];
     self.bottomProgressView.alpha = 0;
     self.logoButton.transform = CGAffineTransformScale(CGAffineTransformIdentity, CGFLOAT_MIN, CGFLOAT_MIN);
@@ -207,11 +275,40 @@
                 cell.itemIcon.transform = CGAffineTransformIdentity;
                 cell.itemTitle.alpha = 1;
             }
-        } completion:nil];
+        } completion:^(BOOL finished) {
+            [self finishAnimation:TapSDKSuiteAnimationModeFull monitor:monitor];
+        }];
+    }];
+}
+
+- (void)showWithCrossFade:(TapSDKSuiteFrameMonitor *)monitor {
+    self.backgroundColor = [UIColor colorWithWhite:0.f alpha:0.6];
+    self.bottomProgressView.alpha = 1;
+    self.logoButton.transform = CGAffineTransformIdentity;
+    self.logoButton.alpha = 1;
+    for (TapFloatingCell *cell in self.itemArray) {
+        cell.itemIcon.transform = CGAffineTransformIdentity;
+        cell.itemIcon.alpha = 1;
+        cell.itemTitle.alpha = 1;
+    }
+    [self layoutIfNeeded];
+    [self beginRasterize];
+    self.alpha = 0;
+    [UIView animateWithDuration:0.2f animations:^{
+        self.alpha = 1;
+    } completion:^(BOOL finished) {
+        self.layer.shouldRasterize = NO;
+        [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(dismissWithAnimation) name:TapFloatCellClickedNotification object:nil];
+        [self finishAnimation:TapSDKSuiteAnimationModeReduced monitor:monitor];
     }];
 }
 
 - (void)dismissWithAnimation {
+    TapSDKSuiteFrameMonitor *monitor = [self startFrameMonitor];
+    if ([TapSDKSuiteUtils shouldReduceAnimation]) {
+        [self dismissWithCrossFade:monitor];
+        return;
+    }
     [UIView animateWithDuration:0.5f
                           delay:0.0f
          usingSpringWithDamping:0.7f
@@ -229,12 +326,54 @@
                          }
                      }
                      completion:^(BOOL finished) {
-                         [[NSNotificationCenter defaultCenter] removeObserver:self name:TapFloatCellClickedNotification object:nil];
-                         [self.scrollView setContentOffset:CGPointZero animated:NO];
-                         [self removeFromSuperview];
+                         [self didDismiss];
+                         [self finishAnimation:TapSDKSuiteAnimationModeFull monitor:monitor];
                      }];
 }
 
+- (void)dismissWithCrossFade:(TapSDKSuiteFrameMonitor *)monitor {
+    [self beginRasterize];
+    [UIView animateWithDuration:0.2f animations:^{
+        self.alpha = 0;
+    } completion:^(BOOL finished) {
+        self.layer.shouldRasterize = NO;
+        [self didDismiss];
+        [self finishAnimation:TapSDKSuiteAnimationModeReduced monitor:monitor];
+    }];
+}
+
+- (void)didDismiss {
+    [[NSNotificationCenter defaultCenter] removeObserver:self name:TapFloatCellClickedNotification object:nil];
+    [self.scrollView setContentOffset:CGPointZero animated:NO];
+    [self removeFromSuperview];
+}
+
+- (void)beginRasterize {
+    // 整个菜单先栅格化为一张位图，渐变期间只对这一层做透明度动画
+    self.layer.rasterizationScale = [UIScreen mainScreen].scale;
+    self.layer.shouldRasterize = YES;
+}
+
+- (TapSDKSuiteFrameMonitor *)startFrameMonitor {
+    // 上一次动画尚未结束时被替换，停止它的监控，其完成回调不再上报
+    [self.frameMonitor stop];
+    self.frameMonitor = [TapSDKSuiteFrameMonitor new];
+    [self.frameMonitor start];
+    return self.frameMonitor;
+}
+
+- (void)finishAnimation:(TapSDKSuiteAnimationMode)mode monitor:(TapSDKSuiteFrameMonitor *)monitor {
+    [monitor stop];
+    if (monitor != self.frameMonitor) {
+        return;
+    }
+    self.frameMonitor = nil;
+    id<TapSDKSuiteDelegate> delegate = [TapSDKSuite shareInstance].delegate;
+    if (delegate && [delegate respondsToSelector:@selector(onAnimationFinished:frameCount:averageFrameTime:maxFrameTime:)]) {
+        [delegate onAnimationFinished:mode frameCount:monitor.frameCount averageFrameTime:monitor.averageFrameTime maxFrameTime:monitor.maxFrameTime];
+    }
+}
+
 - (UIButton *)logoButton {
     if (!_logoButton) {
         _logoButton = [UIButton new];
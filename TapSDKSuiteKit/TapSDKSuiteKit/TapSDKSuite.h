@@ -11,8 +11,11 @@
 NS_ASSUME_NONNULL_BEGIN
 
 @interface TapSDKSuite : NSObject
-@property (nonatomic, strong) NSArray<TapSDKSuiteComponent *> *componentArray;
+/// 可在任意线程设置，同一帧内多次设置只会重建一次悬浮菜单
+@property (atomic, copy) NSArray<TapSDKSuiteComponent *> *componentArray;
 @property (nonatomic, weak) id<TapSDKSuiteDelegate> delegate;
+/// 悬浮菜单展开和收起的动画，默认 TapSDKSuiteAnimationModeAuto
+@property (nonatomic, assign) TapSDKSuiteAnimationMode animationMode;
 
 + (instancetype)new NS_UNAVAILABLE;
 
@@ -20,11 +23,21 @@ NS_ASSUME_NONNULL_BEGIN
 
 + (instancetype)shareInstance;
 
+/// enable、disable 可在任意线程调用，实际操作在主线程执行，短时间内多次调用只执行最后一次
 + (void)enable;
 
 + (void)disable;
 
+/// 主线程上已生效的展示状态，可在任意线程无锁读取
 + (BOOL)isShowing;
+
+/// 回收内存，收到系统内存警告时会自动以 TapSDKSuiteMemoryTrimLevelFloatingView 级别调用
+/// @param level 回收级别，会依次执行该级别及以下的回收
++ (void)trimMemory:(TapSDKSuiteMemoryTrimLevel)level;
+
+/// 设定默认标题的语言，已创建的悬浮菜单会立即刷新可见的入口，其余入口在滚动到可见区域时刷新
+/// @param langType 语言类型
++ (void)setLanguage:(TapSDKSuiteLanguageType)langType;
 @end
 
 NS_ASSUME_NONNULL_END
@@ -5,9 +5,11 @@
 //  Created by Bottle K on 2022/1/4.
 //
 
+#import <stdatomic.h>
 #import "TapSDKSuite.h"
 #import "TapFloatingView.h"
-#import "TapSDKSuiteUtils.h"
+#import "TapSDKSuiteUtils+Internal.h"
+#import "TapSDKSuiteTextCache.h"
 
 @interface TapSDKSuite ()
 @property (nonatomic, strong) UIImageView *roundLogoView;
@@ -15,9 +17,25 @@
 @property (nonatomic, strong) TapFloatingView *floatingView;
 @property (nonatomic, assign) BOOL opened;
 @property (nonatomic, assign) BOOL animating;
+@property (nonatomic, assign) BOOL rebuildScheduled;
 @end
 
+// 主线程上已生效的展示状态，供任意线程无锁读取
+static atomic_bool TapSDKSuiteShowing = false;
+// 最近一次 enable/disable 的序号，主线程只执行序号最新的一次
+static atomic_uint TapSDKSuiteShowingSequence = 0;
+
+// 公开接口可能由游戏引擎在其他线程调用，UIKit 操作统一切回主线程
+static void TapSDKSuiteRunOnMain(dispatch_block_t block) {
+    if ([NSThread isMainThread]) {
+        block();
+    } else {
+        dispatch_async(dispatch_get_main_queue(), block);
+    }
+}
+
 @implementation TapSDKSuite
+@synthesize componentArray = _componentArray;
 
 + (instancetype)shareInstance {
     static TapSDKSuite *instance = nil;
@@ -26,23 +44,81 @@
         instance = [[TapSDKSuite alloc] init];
         instance.opened = NO;
         instance.animating = NO;
+        [[NSNotificationCenter defaultCenter] addObserver:instance selector:@selector(didReceiveMemoryWarning) name:UIApplicationDidReceiveMemoryWarningNotification object:nil];
     });
     return instance;
 }
 
 + (void)enable {
-    [[self shareInstance] enableFloatView];
+    [self requestShowing:YES];
 }
 
 + (void)disable {
-    [[self shareInstance] disableFloatView];
+    [self requestShowing:NO];
 }
 
 + (BOOL)isShowing {
-    return ((TapSDKSuite *)[self shareInstance]).opened;
+    return atomic_load(&TapSDKSuiteShowing);
+}
+
++ (void)trimMemory:(TapSDKSuiteMemoryTrimLevel)level {
+    TapSDKSuiteRunOnMain(^{
+        [[self shareInstance] trimMemoryToLevel:level];
+    });
+}
+
++ (void)setLanguage:(TapSDKSuiteLanguageType)langType {
+    TapSDKSuiteRunOnMain(^{
+        [TapSDKSuiteUtils setCurrentLanguage:langType];
+        // 隐藏中的菜单不会在展开时重建，同样需要刷新
+        [[self shareInstance]->_floatingView reloadTitles];
+    });
+}
+
+- (void)setComponentArray:(NSArray<TapSDKSuiteComponent *> *)componentArray {
+    @synchronized (self) {
+        _componentArray = [componentArray copy];
+        if (self.rebuildScheduled) {
+            return;
+        }
+        self.rebuildScheduled = YES;
+    }
+    // 同一帧内多次设置只在下一次主线程 runloop 重建一次
+    dispatch_async(dispatch_get_main_queue(), ^{
+        NSArray<TapSDKSuiteComponent *> *components;
+        @synchronized (self) {
+            self.rebuildScheduled = NO;
+            components = self->_componentArray;
+        }
+        [TapSDKSuiteUtils preloadIconsOfComponents:components];
+        [self rebuildFloatingView];
+    });
+}
+
+- (NSArray<TapSDKSuiteComponent *> *)componentArray {
+    @synchronized (self) {
+        return _componentArray;
+    }
 }
 
 #pragma mark- internal methods
++ (void)requestShowing:(BOOL)showing {
+    unsigned int sequence = atomic_fetch_add(&TapSDKSuiteShowingSequence, 1) + 1;
+    TapSDKSuiteRunOnMain(^{
+        // 之后已有新的调用，丢弃过期的请求，避免跨线程调用在主线程上乱序生效
+        if (atomic_load(&TapSDKSuiteShowingSequence) != sequence) {
+            return;
+        }
+        if (showing) {
+            [[self shareInstance] enableFloatView];
+        } else {
+            [TapSDKSuiteUtils cancelPreloadIcons];
+            [[self shareInstance] disableFloatView];
+        }
+        atomic_store(&TapSDKSuiteShowing, showing);
+    });
+}
+
 - (void)enableFloatView {
     [self enableFloatViewWithAnimation:self.opened];
     self.opened = YES;
@@ -105,8 +181,70 @@
     _floatingView = nil;
 }
 
+- (void)rebuildFloatingView {
+    if (!_floatingView) {
+        return;
+    }
+    if (_floatingView.superview) {
+        [_floatingView setupData];
+    } else {
+        // 隐藏中的菜单直接释放，下次展开时按新配置创建
+        _floatingView = nil;
+    }
+}
+
+- (void)didReceiveMemoryWarning {
+    [self trimMemoryToLevel:TapSDKSuiteMemoryTrimLevelFloatingView];
+}
+
+- (void)trimMemoryToLevel:(TapSDKSuiteMemoryTrimLevel)level {
+    // 移出缓存后仍被视图引用的位图不会释放：贴边按钮的位图始终不计入，
+    // 菜单引用的位图只在菜单本身被回收时计入 FloatingView 一级
+    NSHashTable<UIImage *> *retainedImages = [NSHashTable hashTableWithOptions:NSPointerFunctionsObjectPointerPersonality];
+    if (_roundLogoView.image) {
+        [retainedImages addObject:_roundLogoView.image];
+    }
+    if ([_cornorFloatButton imageForState:UIControlStateNormal]) {
+        [retainedImages addObject:[_cornorFloatButton imageForState:UIControlStateNormal]];
+    }
+    NSHashTable<UIImage *> *menuImages = [_floatingView referencedImages];
+
+    NSMutableArray<UIImage *> *removedImages = [NSMutableArray array];
+    [removedImages addObjectsFromArray:[TapSDKSuiteTextCache removeAllImages]];
+    [removedImages addObjectsFromArray:[TapSDKSuiteUtils removeCachedBundleImages]];
+    NSUInteger cacheBytes = 0;
+    NSUInteger menuBytes = 0;
+    for (UIImage *image in removedImages) {
+        if ([retainedImages containsObject:image]) {
+            continue;
+        }
+        if ([menuImages containsObject:image]) {
+            menuBytes += [TapSDKSuiteImageCache byteCostOfImage:image];
+        } else {
+            cacheBytes += [TapSDKSuiteImageCache byteCostOfImage:image];
+        }
+    }
+    [self notifyMemoryTrimmed:TapSDKSuiteMemoryTrimLevelCaches bytes:cacheBytes];
+
+    if (level < TapSDKSuiteMemoryTrimLevelFloatingView) {
+        return;
+    }
+    // 展开中的菜单不回收，隐藏的菜单在下次 showFloatWindow 时懒加载重建
+    if (_floatingView && !_floatingView.superview) {
+        _floatingView = nil;
+    } else {
+        menuBytes = 0;
+    }
+    [self notifyMemoryTrimmed:TapSDKSuiteMemoryTrimLevelFloatingView bytes:menuBytes];
+}
+
+- (void)notifyMemoryTrimmed:(TapSDKSuiteMemoryTrimLevel)level bytes:(NSUInteger)bytes {
+    if (self.delegate && [self.delegate respondsToSelector:@selector(onMemoryTrimmed:reclaimedBytes:)]) {
+        [self.delegate onMemoryTrimmed:level reclaimedBytes:bytes];
+    }
+}
+
 - (void)showFloatWindow {
-    [self.floatingView setupData];
     [[UIApplication sharedApplication].keyWindow addSubview:self.floatingView];
     [self.floatingView showWithAnimation];
 }
@@ -119,7 +257,7 @@
     if (!_roundLogoView) {
         _roundLogoView = [UIImageView new];
         _roundLogoView.bounds = CGRectMake(0, 0, 44, 44);
-        [_roundLogoView setImage:[TapSDKSuiteUtils getImageFromBundle:@"ic_logo_round"]];
+        [_roundLogoView setImage:[TapSDKSuiteUtils getImageFromBundle:@"ic_logo_round" size:CGSizeMake(44, 44)]];
     }
     return _roundLogoView;
 }
@@ -139,6 +277,7 @@
 - (TapFloatingView *)floatingView {
     if (!_floatingView) {
         _floatingView = [[TapFloatingView alloc] initWithFrame:CGRectMake(0, 0, [UIScreen mainScreen].bounds.size.width, [UIScreen mainScreen].bounds.size.height)];
+        [_floatingView setupData];
     }
     return _floatingView;
 }
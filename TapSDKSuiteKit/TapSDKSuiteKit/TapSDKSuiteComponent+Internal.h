@@ -0,0 +1,20 @@
+//
+//  TapSDKSuiteComponent+Internal.h
+//  TapSDKSuiteKit
+//
+//  Created by agent on 2026/10/18.
+//
+
+#import "TapSDKSuiteComponent.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+// 仅供 TapSDKSuiteKit 内部使用，不对外公开
+@interface TapSDKSuiteComponent ()
+
+/// 获取图标，可在后台线程调用
+/// @param screenScale 屏幕倍率，需由调用方在主线程读取后传入
+- (UIImage *_Nullable)iconWithScreenScale:(CGFloat)screenScale;
+@end
+
+NS_ASSUME_NONNULL_END
@@ -17,6 +17,18 @@ typedef NS_ENUM (NSInteger, TapSDKSuiteComponentType) {
     TapSDKSuiteComponentTypeLeaderboard
 };
 
+// 取值与 TapCommonSDK 的 TapLanguageType 保持一致，可直接强转传入
+typedef NS_ENUM (NSInteger, TapSDKSuiteLanguageType) {
+    TapSDKSuiteLanguageTypeAuto = 0,// 自动
+    TapSDKSuiteLanguageTypeZhHans,// 简体中文
+    TapSDKSuiteLanguageTypeEn,// 英文
+    TapSDKSuiteLanguageTypeZhHant,// 繁体中文
+    TapSDKSuiteLanguageTypeJa,// 日文
+    TapSDKSuiteLanguageTypeKo,// 韩文
+    TapSDKSuiteLanguageTypeTh,// 泰文
+    TapSDKSuiteLanguageTypeId,// 印度尼西亚语
+};
+
 FOUNDATION_EXPORT NSString *const TapFloatCellClickedNotification;
 
 @interface TapSDKSuiteComponent : NSObject
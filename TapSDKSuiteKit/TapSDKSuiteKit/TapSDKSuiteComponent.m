@@ -5,18 +5,21 @@
 //  Created by Bottle K on 2022/1/4.
 //
 
-#import "TapSDKSuiteComponent.h"
-#import "TapSDKSuiteUtils.h"
+#import "TapSDKSuiteComponent+Internal.h"
+#import "TapSDKSuiteUtils+Internal.h"
 
 NSString *const TapFloatCellClickedNotification = @"TapFloatCellClickedNotification";
 
+// 与 TapFloatingCell 中图标的展示尺寸一致
+static const CGSize TapSDKSuiteIconSize = {50, 50};
+
 @implementation TapSDKSuiteComponent
 - (instancetype)initWithType:(TapSDKSuiteComponentType)type {
     return [self initWithType:type title:nil];
 }
 
 - (instancetype)initWithType:(TapSDKSuiteComponentType)type title:(NSString *_Nullable)title {
-    return [self initWithType:type title:nil icon:nil];
+    return [self initWithType:type title:title icon:nil];
 }
 
 - (instancetype)initWithType:(TapSDKSuiteComponentType)type title:(NSString *_Nullable)title icon:(UIImage *_Nullable)icon {
@@ -29,56 +32,34 @@ NSString *const TapFloatCellClickedNotification = @"TapFloatCellClickedNotificat
 }
 
 - (NSString *)title {
-    if (!_title) {
-        switch (self.type) {
-            case TapSDKSuiteComponentTypeMoment:
-                _title = @"Moments";
-                break;
-            case TapSDKSuiteComponentTypeFirend:
-                _title = @"Friends";
-                break;
-            case TapSDKSuiteComponentTypeAchievement:
-                _title = @"Achievement";
-                break;
-            case TapSDKSuiteComponentTypeChat:
-                _title = @"Chat";
-                break;
-            case TapSDKSuiteComponentTypeLeaderboard:
-                _title = @"Leaderboard";
-                break;
-
-            default:
-                _title = @"title";
-                break;
-        }
-    }
-    return _title;
+    // 未自定义标题时每次按当前语言查表，切换语言后无需重建组件
+    return _title ?: [TapSDKSuiteUtils localizedTitleForType:self.type];
 }
 
 - (UIImage *)icon {
-    if (!_icon) {
-        switch (self.type) {
-            case TapSDKSuiteComponentTypeMoment:
-                _icon = [TapSDKSuiteUtils getImageFromBundle:@"ic_moment"];
-                break;
-            case TapSDKSuiteComponentTypeFirend:
-                _icon = [TapSDKSuiteUtils getImageFromBundle:@"ic_friend"];
-                break;
-            case TapSDKSuiteComponentTypeAchievement:
-                _icon = [TapSDKSuiteUtils getImageFromBundle:@"ic_achievement"];
-                break;
-            case TapSDKSuiteComponentTypeChat:
-                _icon = [TapSDKSuiteUtils getImageFromBundle:@"ic_chat"];
-                break;
-            case TapSDKSuiteComponentTypeLeaderboard:
-                _icon = [TapSDKSuiteUtils getImageFromBundle:@"ic_leaderboard"];
-                break;
+    return [self iconWithScreenScale:[UIScreen mainScreen].scale];
+}
+
+- (UIImage *)iconWithScreenScale:(CGFloat)screenScale {
+    // 未自定义图标时从共享缓存读取，不由组件持有，内存紧张时可整体释放
+    if (_icon) {
+        return _icon;
+    }
+    switch (self.type) {
+        case TapSDKSuiteComponentTypeMoment:
+            return [TapSDKSuiteUtils getImageFromBundle:@"ic_moment" size:TapSDKSuiteIconSize screenScale:screenScale];
+        case TapSDKSuiteComponentTypeFirend:
+            return [TapSDKSuiteUtils getImageFromBundle:@"ic_friend" size:TapSDKSuiteIconSize screenScale:screenScale];
+        case TapSDKSuiteComponentTypeAchievement:
+            return [TapSDKSuiteUtils getImageFromBundle:@"ic_achievement" size:TapSDKSuiteIconSize screenScale:screenScale];
+        case TapSDKSuiteComponentTypeChat:
+            return [TapSDKSuiteUtils getImageFromBundle:@"ic_chat" size:TapSDKSuiteIconSize screenScale:screenScale];
+        case TapSDKSuiteComponentTypeLeaderboard:
+            return [TapSDKSuiteUtils getImageFromBundle:@"ic_leaderboard" size:TapSDKSuiteIconSize screenScale:screenScale];
 
-            default:
-                break;
-        }
+        default:
+            return nil;
     }
-    return _icon;
 }
 
 @end
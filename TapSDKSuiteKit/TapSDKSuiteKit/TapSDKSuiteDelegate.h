@@ -9,10 +9,34 @@
 #import <TapSDKSuiteKit/TapSDKSuiteComponent.h>
 NS_ASSUME_NONNULL_BEGIN
 
+typedef NS_ENUM (NSInteger, TapSDKSuiteMemoryTrimLevel) {
+    TapSDKSuiteMemoryTrimLevelCaches,// 清空标题位图和图标缓存
+    TapSDKSuiteMemoryTrimLevelFloatingView,// 同时释放隐藏中的悬浮菜单，下次展开时重建，贴边按钮始终保留
+};
+
+typedef NS_ENUM (NSInteger, TapSDKSuiteAnimationMode) {
+    TapSDKSuiteAnimationModeAuto,// 开启减弱动态效果、低电量模式或设备过热时使用渐变，否则使用完整动画
+    TapSDKSuiteAnimationModeFull,// 完整的缩放和弹簧动画
+    TapSDKSuiteAnimationModeReduced,// 整个菜单栅格化后做一次渐变
+};
+
 @protocol TapSDKSuiteDelegate <NSObject>
 
 - (void)onItemClick:(TapSDKSuiteComponent*)component;
 
+@optional
+/// 内存回收完成，每一级分别回调
+/// @param level 回收级别
+/// @param bytes 该级实际释放的位图字节数，仍被视图或自定义图标引用的位图不计入
+- (void)onMemoryTrimmed:(TapSDKSuiteMemoryTrimLevel)level reclaimedBytes:(NSUInteger)bytes;
+
+/// 悬浮菜单展开或收起动画结束，可用于对比两种动画的帧耗时
+/// @param mode 实际使用的动画，TapSDKSuiteAnimationModeFull 或 TapSDKSuiteAnimationModeReduced
+/// @param frameCount 动画期间的帧数
+/// @param averageFrameTime 平均帧间隔，单位秒
+/// @param maxFrameTime 最大帧间隔，单位秒
+- (void)onAnimationFinished:(TapSDKSuiteAnimationMode)mode frameCount:(NSUInteger)frameCount averageFrameTime:(NSTimeInterval)averageFrameTime maxFrameTime:(NSTimeInterval)maxFrameTime;
+
 @end
 
 NS_ASSUME_NONNULL_END
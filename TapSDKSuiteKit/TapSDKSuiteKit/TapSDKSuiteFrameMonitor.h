@@ -0,0 +1,23 @@
+//
+//  TapSDKSuiteFrameMonitor.h
+//  TapSDKSuiteKit
+//
+//  Created by agent on 2026/10/18.
+//
+
+#import <UIKit/UIKit.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// 统计一段动画期间的帧间隔
+@interface TapSDKSuiteFrameMonitor : NSObject
+@property (nonatomic, assign, readonly) NSUInteger frameCount;
+@property (nonatomic, assign, readonly) NSTimeInterval averageFrameTime;
+@property (nonatomic, assign, readonly) NSTimeInterval maxFrameTime;
+
+- (void)start;
+
+- (void)stop;
+@end
+
+NS_ASSUME_NONNULL_END
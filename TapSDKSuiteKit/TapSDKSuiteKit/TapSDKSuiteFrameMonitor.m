@@ -0,0 +1,50 @@
+//
+//  TapSDKSuiteFrameMonitor.m
+//  TapSDKSuiteKit
+//
+//  Created by agent on 2026/10/18.
+//
+
+#import "TapSDKSuiteFrameMonitor.h"
+
+@interface TapSDKSuiteFrameMonitor ()
+@property (nonatomic, strong) CADisplayLink *displayLink;
+@property (nonatomic, assign) CFTimeInterval lastTimestamp;
+@property (nonatomic, assign) CFTimeInterval totalFrameTime;
+@property (nonatomic, assign, readwrite) NSUInteger frameCount;
+@property (nonatomic, assign, readwrite) NSTimeInterval maxFrameTime;
+@end
+
+@implementation TapSDKSuiteFrameMonitor
+
+- (void)start {
+    [self.displayLink invalidate];
+    self.lastTimestamp = 0;
+    self.totalFrameTime = 0;
+    self.frameCount = 0;
+    self.maxFrameTime = 0;
+    // displayLink 会持有 target，stop 时必须 invalidate
+    self.displayLink = [CADisplayLink displayLinkWithTarget:self selector:@selector(onFrame:)];
+    [self.displayLink addToRunLoop:[NSRunLoop mainRunLoop] forMode:NSRunLoopCommonModes];
+}
+
+- (void)stop {
+    [self.displayLink invalidate];
+    self.displayLink = nil;
+}
+
+- (void)onFrame:(CADisplayLink *)link {
+    if (self.lastTimestamp > 0) {
+        CFTimeInterval frameTime = link.timestamp - self.lastTimestamp;
+        self.totalFrameTime += frameTime;
+        self.frameCount++;
+        self.maxFrameTime = MAX(self.maxFrameTime, frameTime);
+    }
+    self.lastTimestamp = link.timestamp;
+}
+
+- (NSTimeInterval)averageFrameTime {
+    return self.frameCount > 0 ? self.totalFrameTime / self.frameCount : 0;
+}
+
+@end
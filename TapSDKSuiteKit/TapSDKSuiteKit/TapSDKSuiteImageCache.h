@@ -0,0 +1,45 @@
+//
+//  TapSDKSuiteImageCache.h
+//  TapSDKSuiteKit
+//
+//  Created by agent on 2026/10/18.
+//
+
+#import <UIKit/UIKit.h>
+#import "TapSDKSuiteUtils.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// 按解码后字节数计费的 LRU 位图缓存，每个命名空间一个实例、各自加锁
+@interface TapSDKSuiteImageCache : NSObject
+@property (nonatomic, copy, readonly) NSString *name;
+/// 字节数上限，超出时淘汰最久未使用的位图
+@property (nonatomic, assign) NSUInteger costLimit;
+/// 当前缓存位图解码后的总字节数
+@property (nonatomic, assign, readonly) NSUInteger totalBytes;
+
++ (instancetype)new NS_UNAVAILABLE;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+- (instancetype)initWithName:(NSString *)name costLimit:(NSUInteger)costLimit;
+
+- (UIImage *_Nullable)imageForKey:(NSString *)key;
+
+- (void)setImage:(UIImage *)image forKey:(NSString *)key;
+
+/// 仅在 key 不存在时写入，已存在时保留缓存中的位图
+/// @return 缓存中最终对应 key 的位图，超出字节上限未写入时返回传入的位图
+- (UIImage *)setImageIfAbsent:(UIImage *)image forKey:(NSString *)key;
+
+/// 清空缓存
+/// @return 被移出缓存的位图，仍被其他对象引用的位图并不会随之释放
+- (NSArray<UIImage *> *)removeAllImages;
+
+/// 命中、淘汰和字节数的统计快照
+- (TapSDKSuiteCacheStatistics)statistics;
+
++ (NSUInteger)byteCostOfImage:(UIImage *_Nullable)image;
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,184 @@
+//
+//  TapSDKSuiteImageCache.m
+//  TapSDKSuiteKit
+//
+//  Created by agent on 2026/10/18.
+//
+
+#import "TapSDKSuiteImageCache.h"
+
+@interface TapSDKSuiteImageCacheNode : NSObject
+@property (nonatomic, copy) NSString *key;
+@property (nonatomic, strong) UIImage *image;
+@property (nonatomic, assign) NSUInteger cost;
+// 节点由 nodes 和 next 链持有，反向指针不走 weak 表
+@property (nonatomic, unsafe_unretained) TapSDKSuiteImageCacheNode *prev;
+@property (nonatomic, strong) TapSDKSuiteImageCacheNode *next;
+@end
+
+@implementation TapSDKSuiteImageCacheNode
+@end
+
+@interface TapSDKSuiteImageCache ()
+@property (nonatomic, copy, readwrite) NSString *name;
+@property (nonatomic, assign, readwrite) NSUInteger totalBytes;
+@property (nonatomic, strong) NSMutableDictionary<NSString *, TapSDKSuiteImageCacheNode *> *nodes;
+// 链表头为最近使用，尾为最久未使用
+@property (nonatomic, strong) TapSDKSuiteImageCacheNode *head;
+@property (nonatomic, unsafe_unretained) TapSDKSuiteImageCacheNode *tail;
+@property (nonatomic, assign) TapSDKSuiteCacheStatistics stats;
+@end
+
+@implementation TapSDKSuiteImageCache
+
+- (instancetype)initWithName:(NSString *)name costLimit:(NSUInteger)costLimit {
+    if (self = [super init]) {
+        _name = [name copy];
+        _costLimit = costLimit;
+        _nodes = [NSMutableDictionary dictionary];
+    }
+    return self;
+}
+
+- (UIImage *)imageForKey:(NSString *)key {
+    @synchronized (self) {
+        TapSDKSuiteImageCacheNode *node = self.nodes[key];
+        if (!node) {
+            _stats.missCount++;
+            return nil;
+        }
+        _stats.hitCount++;
+        [self unlinkNode:node];
+        [self insertNodeAtHead:node];
+        return node.image;
+    }
+}
+
+- (void)setImage:(UIImage *)image forKey:(NSString *)key {
+    NSUInteger cost = [TapSDKSuiteImageCache byteCostOfImage:image];
+    @synchronized (self) {
+        [self removeNodeForKey:key];
+        [self addImage:image forKey:key cost:cost];
+    }
+}
+
+- (UIImage *)setImageIfAbsent:(UIImage *)image forKey:(NSString *)key {
+    NSUInteger cost = [TapSDKSuiteImageCache byteCostOfImage:image];
+    @synchronized (self) {
+        TapSDKSuiteImageCacheNode *node = self.nodes[key];
+        if (node) {
+            [self unlinkNode:node];
+            [self insertNodeAtHead:node];
+            return node.image;
+        }
+        [self addImage:image forKey:key cost:cost];
+        return image;
+    }
+}
+
+- (NSArray<UIImage *> *)removeAllImages {
+    @synchronized (self) {
+        NSMutableArray<UIImage *> *images = [NSMutableArray arrayWithCapacity:self.nodes.count];
+        for (TapSDKSuiteImageCacheNode *node in self.nodes.allValues) {
+            [images addObject:node.image];
+        }
+        _stats.clearEvictionCount += self.nodes.count;
+        [self.nodes removeAllObjects];
+        self.head = nil;
+        self.tail = nil;
+        _totalBytes = 0;
+        return images;
+    }
+}
+
+- (void)setCostLimit:(NSUInteger)costLimit {
+    @synchronized (self) {
+        _costLimit = costLimit;
+        [self trimToCostLimit];
+    }
+}
+
+- (TapSDKSuiteCacheStatistics)statistics {
+    @synchronized (self) {
+        TapSDKSuiteCacheStatistics stats = _stats;
+        stats.totalBytes = _totalBytes;
+        return stats;
+    }
+}
+
+- (NSUInteger)totalBytes {
+    @synchronized (self) {
+        return _totalBytes;
+    }
+}
+
++ (NSUInteger)byteCostOfImage:(UIImage *)image {
+    CGImageRef cgImage = image.CGImage;
+    if (!cgImage) {
+        return 0;
+    }
+    return CGImageGetBytesPerRow(cgImage) * CGImageGetHeight(cgImage);
+}
+
+#pragma mark- internal methods
+// 以下方法均在持有锁时调用
+- (void)trimToCostLimit {
+    while (_totalBytes > _costLimit && self.tail) {
+        [self removeNodeForKey:self.tail.key];
+        _stats.limitEvictionCount++;
+    }
+}
+
+- (void)addImage:(UIImage *)image forKey:(NSString *)key cost:(NSUInteger)cost {
+    if (cost > _costLimit) {
+        return;
+    }
+    TapSDKSuiteImageCacheNode *node = [TapSDKSuiteImageCacheNode new];
+    node.key = key;
+    node.image = image;
+    node.cost = cost;
+    self.nodes[key] = node;
+    [self insertNodeAtHead:node];
+    _totalBytes += cost;
+    _stats.peakBytes = MAX(_stats.peakBytes, _totalBytes);
+    [self trimToCostLimit];
+}
+
+- (void)removeNodeForKey:(NSString *)key {
+    TapSDKSuiteImageCacheNode *node = self.nodes[key];
+    if (!node) {
+        return;
+    }
+    [self unlinkNode:node];
+    [self.nodes removeObjectForKey:key];
+    _totalBytes -= MIN(_totalBytes, node.cost);
+}
+
+- (void)insertNodeAtHead:(TapSDKSuiteImageCacheNode *)node {
+    node.prev = nil;
+    node.next = self.head;
+    self.head.prev = node;
+    self.head = node;
+    if (!self.tail) {
+        self.tail = node;
+    }
+}
+
+- (void)unlinkNode:(TapSDKSuiteImageCacheNode *)node {
+    TapSDKSuiteImageCacheNode *prev = node.prev;
+    TapSDKSuiteImageCacheNode *next = node.next;
+    if (prev) {
+        prev.next = next;
+    } else {
+        self.head = next;
+    }
+    if (next) {
+        next.prev = prev;
+    } else {
+        self.tail = prev;
+    }
+    node.prev = nil;
+    node.next = nil;
+}
+
+@end
@@ -0,0 +1,29 @@
+//
+//  TapSDKSuiteTextCache.h
+//  TapSDKSuiteKit
+//
+//  Created by agent on 2026/10/18.
+//
+
+#import <UIKit/UIKit.h>
+#import "TapSDKSuiteImageCache.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface TapSDKSuiteTextCache : NSObject
+
+/// 获取文字渲染后的图片，按 (文字, 字体, 屏幕倍率, 颜色) 缓存，所有入口共享
+/// @param text 文字
+/// @param font 字体
+/// @param color 文字颜色
+/// @param maxWidth 最大宽度，单位 pt，超出时与 UILabel 一样在末尾截断并显示省略号
++ (UIImage *_Nullable)imageWithText:(NSString *)text font:(UIFont *)font color:(UIColor *)color maxWidth:(CGFloat)maxWidth;
+
++ (TapSDKSuiteImageCache *)cache;
+
+/// 清空缓存
+/// @return 被移出缓存的位图
++ (NSArray<UIImage *> *)removeAllImages;
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,68 @@
+//
+//  TapSDKSuiteTextCache.m
+//  TapSDKSuiteKit
+//
+//  Created by agent on 2026/10/18.
+//
+
+#import "TapSDKSuiteTextCache.h"
+
+@implementation TapSDKSuiteTextCache
+
++ (TapSDKSuiteImageCache *)cache {
+    static TapSDKSuiteImageCache *cache = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        // 单个标题位图约数十 KB
+        cache = [[TapSDKSuiteImageCache alloc] initWithName:@"title" costLimit:1024 * 1024];
+    });
+    return cache;
+}
+
++ (UIImage *)imageWithText:(NSString *)text font:(UIFont *)font color:(UIColor *)color maxWidth:(CGFloat)maxWidth {
+    if (text.length == 0 || maxWidth <= 0) {
+        return nil;
+    }
+    CGFloat scale = [UIScreen mainScreen].scale;
+    // 放得下的标题与宽度无关，按不含宽度的 key 缓存，不同位置的入口共享同一张位图
+    NSString *key = [self keyWithText:text font:font color:color scale:scale];
+    UIImage *image = [[self cache] imageForKey:key];
+    if (image && image.size.width <= maxWidth) {
+        return image;
+    }
+    NSString *truncatedKey = [NSString stringWithFormat:@"%@|%.1f", key, maxWidth];
+    image = [[self cache] imageForKey:truncatedKey];
+    if (image) {
+        return image;
+    }
+
+    NSMutableParagraphStyle *paragraphStyle = [NSMutableParagraphStyle new];
+    paragraphStyle.lineBreakMode = NSLineBreakByTruncatingTail;
+    NSDictionary *attributes = @{NSFontAttributeName: font, NSForegroundColorAttributeName: color, NSParagraphStyleAttributeName: paragraphStyle};
+    CGSize size = [text sizeWithAttributes:attributes];
+    BOOL truncated = ceil(size.width) > maxWidth;
+    size = CGSizeMake(truncated ? floor(maxWidth) : ceil(size.width), ceil(size.height));
+
+    UIGraphicsBeginImageContextWithOptions(size, NO, scale);
+    [text drawInRect:CGRectMake(0, 0, size.width, size.height) withAttributes:attributes];
+    image = UIGraphicsGetImageFromCurrentImageContext();
+    UIGraphicsEndImageContext();
+
+    if (image) {
+        [[self cache] setImage:image forKey:truncated ? truncatedKey : key];
+    }
+    return image;
+}
+
++ (NSArray<UIImage *> *)removeAllImages {
+    return [[self cache] removeAllImages];
+}
+
++ (NSString *)keyWithText:(NSString *)text font:(UIFont *)font color:(UIColor *)color scale:(CGFloat)scale {
+    CGFloat red = 0, green = 0, blue = 0, alpha = 0;
+    [color getRed:&red green:&green blue:&blue alpha:&alpha];
+    return [NSString stringWithFormat:@"%@|%@|%.1f|%.1f|%02X%02X%02X%02X", text, font.fontName, font.pointSize, scale,
+            (int)(red * 255), (int)(green * 255), (int)(blue * 255), (int)(alpha * 255)];
+}
+
+@end
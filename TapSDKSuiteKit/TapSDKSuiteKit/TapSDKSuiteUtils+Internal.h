@@ -0,0 +1,40 @@
+//
+//  TapSDKSuiteUtils+Internal.h
+//  TapSDKSuiteKit
+//
+//  Created by agent on 2026/10/18.
+//
+
+#import "TapSDKSuiteUtils.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+// 仅供 TapSDKSuiteKit 内部使用，不对外公开
+@interface TapSDKSuiteUtils ()
+
+/// 设置默认标题语言，需要同时刷新悬浮菜单时请使用 +[TapSDKSuite setLanguage:]
++ (void)setCurrentLanguage:(TapSDKSuiteLanguageType)langType;
+
++ (NSString *)localizedTitleForType:(TapSDKSuiteComponentType)type;
+
+/// 按展示尺寸解码图片，可在后台线程调用
+/// @param imageName 图片名
+/// @param size 展示尺寸，单位 pt
+/// @param screenScale 屏幕倍率，需由调用方在主线程读取后传入
++ (UIImage *_Nullable)getImageFromBundle:(NSString *)imageName size:(CGSize)size screenScale:(CGFloat)screenScale;
+
+/// 在后台串行队列预先解码组件图标，需在主线程调用
++ (void)preloadIconsOfComponents:(NSArray<TapSDKSuiteComponent *> *)components;
+
+/// 取消尚未完成的预解码
++ (void)cancelPreloadIcons;
+
+/// 按 TapSDKSuite.animationMode 和系统状态决定悬浮菜单是否使用渐变动画
++ (BOOL)shouldReduceAnimation;
+
+/// 清空 bundle 图片缓存
+/// @return 被移出缓存的位图
++ (NSArray<UIImage *> *)removeCachedBundleImages;
+@end
+
+NS_ASSUME_NONNULL_END
@@ -10,12 +10,38 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+typedef NS_ENUM (NSInteger, TapSDKSuiteCacheType) {
+    TapSDKSuiteCacheTypeTitle,// 标题文字位图
+    TapSDKSuiteCacheTypeBundle,// TapSDKSuiteResource.bundle 中的图片
+};
+
+typedef struct {
+    NSUInteger hitCount;
+    NSUInteger missCount;
+    NSUInteger limitEvictionCount;// 超出字节上限被淘汰的数量
+    NSUInteger clearEvictionCount;// 内存回收时被清空的数量
+    NSUInteger totalBytes;
+    NSUInteger peakBytes;
+} TapSDKSuiteCacheStatistics;
+
 @interface TapSDKSuiteUtils : NSObject
 
 + (NSArray <TapSDKSuiteComponent *> *)currentConfig;
 
 + (UIImage *)getImageFromBundle:(NSString *)imageName;
 
+/// 按展示尺寸直接解码图片，避免大图解码后再缩放，结果按 (图片名, 像素尺寸, 屏幕倍率) 缓存
+/// @param imageName 图片名
+/// @param size 展示尺寸，单位 pt
++ (UIImage *)getImageFromBundle:(NSString *)imageName size:(CGSize)size;
+
+/// 获取缓存统计快照
+/// @param type 缓存类型
++ (TapSDKSuiteCacheStatistics)cacheStatistics:(TapSDKSuiteCacheType)type;
+
+/// 所有缓存的统计信息，每个缓存一行，便于输出到日志
++ (NSString *)cacheStatisticsDescription;
+
 + (UIEdgeInsets)safeAreaInset:(UIView *)view;
 
 + (UIEdgeInsets)safeAreaInsetOfKeyWindow;
@@ -5,8 +5,34 @@
 //  Created by Bottle K on 2022/1/4.
 //
 
-#import "TapSDKSuiteUtils.h"
+#import <ImageIO/ImageIO.h>
+#import <stdatomic.h>
+#import "TapSDKSuiteUtils+Internal.h"
+#import "TapSDKSuiteComponent+Internal.h"
 #import "TapSDKSuite.h"
+#import "TapSDKSuiteImageCache.h"
+#import "TapSDKSuiteTextCache.h"
+
+#define TAP_SUITE_TITLE_LANG_COUNT 7
+#define TAP_SUITE_TITLE_TYPE_COUNT 5
+
+// 默认标题表编译进只读数据段，行按 TapSDKSuiteLanguageType - 1 排列，列按 TapSDKSuiteComponentType 排列
+static NSString *const TapSDKSuiteTitleTable[TAP_SUITE_TITLE_LANG_COUNT][TAP_SUITE_TITLE_TYPE_COUNT] = {
+    {@"动态", @"好友", @"成就", @"聊天", @"排行榜"},
+    {@"Moments", @"Friends", @"Achievement", @"Chat", @"Leaderboard"},
+    {@"動態", @"好友", @"成就", @"聊天", @"排行榜"},
+    {@"モーメント", @"フレンド", @"実績", @"チャット", @"ランキング"},
+    {@"모먼트", @"친구", @"업적", @"채팅", @"리더보드"},
+    {@"โมเมนต์", @"เพื่อน", @"ความสำเร็จ", @"แชท", @"ลีดเดอร์บอร์ด"},
+    {@"Momen", @"Teman", @"Pencapaian", @"Obrolan", @"Papan Peringkat"},
+};
+
+// 每次预解码递增，旧的预解码发现编号变化后停止
+static atomic_uint TapSDKSuitePreloadGeneration = 0;
+
+// 当前语言在标题表中的行号，设置语言时解析一次，查表时只做下标读取
+// 主线程设置语言，任意线程读取 component.title 时可能懒加载初始化，因此使用原子变量
+static atomic_long TapSDKSuiteTitleLangIndex = -1;
 
 @implementation TapSDKSuiteUtils
 
@@ -15,14 +41,239 @@
 }
 
 + (UIImage *)getImageFromBundle:(NSString *)imageName {
+    return [self getImageFromBundle:imageName size:CGSizeZero];
+}
+
++ (UIImage *)getImageFromBundle:(NSString *)imageName size:(CGSize)size {
+    return [self getImageFromBundle:imageName size:size screenScale:[UIScreen mainScreen].scale];
+}
+
++ (UIImage *)getImageFromBundle:(NSString *)imageName size:(CGSize)size screenScale:(CGFloat)screenScale {
+    BOOL originalSize = CGSizeEqualToSize(size, CGSizeZero);
+    // 按像素尺寸区分，44.4pt 与 44pt 不会共用同一张位图
+    NSString *key = originalSize ? imageName : [NSString stringWithFormat:@"%@|%.0fx%.0fpx|%.0f", imageName, ceil(size.width * screenScale), ceil(size.height * screenScale), screenScale];
+    UIImage *image = [[self bundleImageCache] imageForKey:key];
+    if (image) {
+        return image;
+    }
+
+    // 同一张图片同时只解码一次，其余后台调用方等待并复用结果
+    NSMutableDictionary<NSString *, dispatch_group_t> *decodingGroups = [self decodingGroups];
+    dispatch_group_t group;
+    BOOL decoding = NO;
+    @synchronized (decodingGroups) {
+        group = decodingGroups[key];
+        if (!group) {
+            group = dispatch_group_create();
+            dispatch_group_enter(group);
+            decodingGroups[key] = group;
+            decoding = YES;
+        }
+    }
+    // 主线程不等待低优先级解码队列上的同一张图片，避免优先级反转，直接自行解码
+    if (!decoding && ![NSThread isMainThread]) {
+        dispatch_group_wait(group, DISPATCH_TIME_FOREVER);
+        image = [[self bundleImageCache] imageForKey:key];
+        if (image) {
+            return image;
+        }
+    }
+
+    image = [self loadImageFromBundle:imageName size:size screenScale:screenScale];
+    if (image) {
+        // 主线程与预解码可能同时解码同一张图片，先写入的一份为准，调用方和缓存始终持有同一张位图
+        image = [[self bundleImageCache] setImageIfAbsent:image forKey:key];
+    }
+    if (decoding) {
+        @synchronized (decodingGroups) {
+            [decodingGroups removeObjectForKey:key];
+        }
+        dispatch_group_leave(group);
+    }
+    return image;
+}
+
++ (UIImage *)loadImageFromBundle:(NSString *)imageName size:(CGSize)size screenScale:(CGFloat)screenScale {
+    UIImage *image = nil;
     NSBundle *bundle = [self getBundleWithName:@"TapSDKSuiteResource" aClass:[self class]];
-    NSString *img_path = [bundle.bundlePath stringByAppendingFormat:@"/images/%@", imageName];
+    CGFloat scale = 1;
+    NSString *img_path = [self imagePathInDirectory:[bundle.bundlePath stringByAppendingPathComponent:@"images"] name:imageName screenScale:screenScale scale:&scale];
     if (img_path && img_path.length > 0) {
-        return [UIImage imageWithContentsOfFile:img_path];
+        NSData *data = [NSData dataWithContentsOfFile:img_path];
+        if (data) {
+            CGFloat maxPixelSize = CGSizeEqualToSize(size, CGSizeZero) ? 0 : ceil(MAX(size.width, size.height) * screenScale);
+            image = [self decodeImageData:data maxPixelSize:maxPixelSize fileScale:scale screenScale:screenScale];
+        }
+    }
+    return image;
+}
+
++ (NSMutableDictionary<NSString *, dispatch_group_t> *)decodingGroups {
+    static NSMutableDictionary *groups = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        groups = [NSMutableDictionary dictionary];
+    });
+    return groups;
+}
+
+/// 立即解码图片，返回的位图上屏时无需再解码
+/// @param maxPixelSize 目标像素，原图更大时按该尺寸解码缩略图，传 0 表示按原尺寸解码
+/// @param fileScale 文件本身的倍率，按原尺寸解码时使用
+/// @param screenScale 屏幕倍率，解码缩略图时使用
++ (UIImage *)decodeImageData:(NSData *)data maxPixelSize:(CGFloat)maxPixelSize fileScale:(CGFloat)fileScale screenScale:(CGFloat)screenScale {
+    CGImageSourceRef source = CGImageSourceCreateWithData((__bridge CFDataRef)data, NULL);
+    if (!source) {
+        return nil;
+    }
+    NSDictionary *properties = (__bridge_transfer NSDictionary *)CGImageSourceCopyPropertiesAtIndex(source, 0, NULL);
+    CGFloat pixelWidth = [properties[(__bridge NSString *)kCGImagePropertyPixelWidth] doubleValue];
+    CGFloat pixelHeight = [properties[(__bridge NSString *)kCGImagePropertyPixelHeight] doubleValue];
+    CGImageRef cgImage = NULL;
+    CGFloat scale = fileScale;
+    UIImageOrientation orientation = UIImageOrientationUp;
+    if (maxPixelSize > 0 && MAX(pixelWidth, pixelHeight) > maxPixelSize) {
+        // 直接按目标像素解码缩略图，不会先解码出完整尺寸的位图
+        NSDictionary *options = @{(__bridge NSString *)kCGImageSourceCreateThumbnailFromImageAlways: @YES,
+                                  (__bridge NSString *)kCGImageSourceCreateThumbnailWithTransform: @YES,
+                                  (__bridge NSString *)kCGImageSourceShouldCacheImmediately: @YES,
+                                  (__bridge NSString *)kCGImageSourceThumbnailMaxPixelSize: @(maxPixelSize)};
+        cgImage = CGImageSourceCreateThumbnailAtIndex(source, 0, (__bridge CFDictionaryRef)options);
+        scale = screenScale;
+    } else {
+        // 原图不大于目标像素时按原尺寸解码，同样在此处立即解码，而不是推迟到首次绘制
+        NSDictionary *options = @{(__bridge NSString *)kCGImageSourceShouldCacheImmediately: @YES};
+        cgImage = CGImageSourceCreateImageAtIndex(source, 0, (__bridge CFDictionaryRef)options);
+        // 缩略图已按 EXIF 方向旋转，原尺寸位图需要把方向交给 UIImage
+        orientation = [self imageOrientationFromProperty:[properties[(__bridge NSString *)kCGImagePropertyOrientation] unsignedIntValue]];
+    }
+    CFRelease(source);
+    if (!cgImage) {
+        return nil;
+    }
+    UIImage *image = [UIImage imageWithCGImage:cgImage scale:scale orientation:orientation];
+    CGImageRelease(cgImage);
+    return image;
+}
+
++ (UIImageOrientation)imageOrientationFromProperty:(uint32_t)orientation {
+    switch (orientation) {
+        case kCGImagePropertyOrientationUpMirrored:
+            return UIImageOrientationUpMirrored;
+        case kCGImagePropertyOrientationDown:
+            return UIImageOrientationDown;
+        case kCGImagePropertyOrientationDownMirrored:
+            return UIImageOrientationDownMirrored;
+        case kCGImagePropertyOrientationLeftMirrored:
+            return UIImageOrientationLeftMirrored;
+        case kCGImagePropertyOrientationRight:
+            return UIImageOrientationRight;
+        case kCGImagePropertyOrientationRightMirrored:
+            return UIImageOrientationRightMirrored;
+        case kCGImagePropertyOrientationLeft:
+            return UIImageOrientationLeft;
+
+        default:
+            return UIImageOrientationUp;
+    }
+}
+
++ (void)preloadIconsOfComponents:(NSArray<TapSDKSuiteComponent *> *)components {
+    // UIScreen 只能在主线程读取，解码队列使用这里取到的倍率
+    CGFloat screenScale = [UIScreen mainScreen].scale;
+    unsigned int generation = atomic_fetch_add(&TapSDKSuitePreloadGeneration, 1) + 1;
+    dispatch_async([self decodeQueue], ^{
+        for (TapSDKSuiteComponent *component in components) {
+            // 配置已被替换或预解码被取消时不再解码剩余图标
+            if (atomic_load(&TapSDKSuitePreloadGeneration) != generation) {
+                return;
+            }
+            [component iconWithScreenScale:screenScale];
+        }
+    });
+}
+
++ (void)cancelPreloadIcons {
+    atomic_fetch_add(&TapSDKSuitePreloadGeneration, 1);
+}
+
++ (dispatch_queue_t)decodeQueue {
+    static dispatch_queue_t queue = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        // 串行队列，后台同时最多解码一张图片
+        dispatch_queue_attr_t attr = dispatch_queue_attr_make_with_qos_class(DISPATCH_QUEUE_SERIAL, QOS_CLASS_UTILITY, 0);
+        queue = dispatch_queue_create("com.tds.TapSDKSuiteKit.decode", attr);
+    });
+    return queue;
+}
+
++ (NSString *)imagePathInDirectory:(NSString *)directory name:(NSString *)imageName screenScale:(CGFloat)screenScale scale:(CGFloat *)scale {
+    NSString *extension = imageName.pathExtension.length > 0 ? imageName.pathExtension : @"png";
+    NSString *baseName = imageName.stringByDeletingPathExtension;
+    NSFileManager *fileManager = [NSFileManager defaultManager];
+    // 图片名已带倍率后缀（如 foo@2x.png）时直接使用该文件，倍率取自后缀
+    NSRange suffixRange = [baseName rangeOfString:@"@[1-9]x$" options:NSRegularExpressionSearch];
+    if (suffixRange.location != NSNotFound) {
+        NSString *path = [directory stringByAppendingPathComponent:[baseName stringByAppendingPathExtension:extension]];
+        if (![fileManager fileExistsAtPath:path]) {
+            return nil;
+        }
+        *scale = [baseName substringWithRange:NSMakeRange(suffixRange.location + 1, 1)].doubleValue;
+        return path;
+    }
+    // 优先匹配当前屏幕倍率，其次按高倍率到低倍率查找
+    NSMutableOrderedSet *scales = [NSMutableOrderedSet orderedSetWithObject:@((NSInteger)screenScale)];
+    [scales addObjectsFromArray:@[@3, @2]];
+    for (NSNumber *candidate in scales) {
+        NSString *path = [directory stringByAppendingPathComponent:[NSString stringWithFormat:@"%@@%@x.%@", baseName, candidate, extension]];
+        if ([fileManager fileExistsAtPath:path]) {
+            *scale = candidate.doubleValue;
+            return path;
+        }
+    }
+    NSString *path = [directory stringByAppendingPathComponent:[baseName stringByAppendingPathExtension:extension]];
+    if ([fileManager fileExistsAtPath:path]) {
+        *scale = 1;
+        return path;
     }
     return nil;
 }
 
++ (NSArray<UIImage *> *)removeCachedBundleImages {
+    return [[self bundleImageCache] removeAllImages];
+}
+
++ (TapSDKSuiteCacheStatistics)cacheStatistics:(TapSDKSuiteCacheType)type {
+    return [[self cacheOfType:type] statistics];
+}
+
++ (NSString *)cacheStatisticsDescription {
+    NSMutableArray *lines = [NSMutableArray array];
+    for (TapSDKSuiteImageCache *cache in @[[self cacheOfType:TapSDKSuiteCacheTypeTitle], [self cacheOfType:TapSDKSuiteCacheTypeBundle]]) {
+        TapSDKSuiteCacheStatistics stats = [cache statistics];
+        [lines addObject:[NSString stringWithFormat:@"[TapSDKSuite] cache %@ hit %lu miss %lu evict(limit) %lu evict(clear) %lu bytes %lu peak %lu limit %lu",
+                          cache.name, (unsigned long)stats.hitCount, (unsigned long)stats.missCount,
+                          (unsigned long)stats.limitEvictionCount, (unsigned long)stats.clearEvictionCount,
+                          (unsigned long)stats.totalBytes, (unsigned long)stats.peakBytes, (unsigned long)cache.costLimit]];
+    }
+    return [lines componentsJoinedByString:@"\n"];
+}
+
++ (TapSDKSuiteImageCache *)cacheOfType:(TapSDKSuiteCacheType)type {
+    return type == TapSDKSuiteCacheTypeTitle ? [TapSDKSuiteTextCache cache] : [self bundleImageCache];
+}
+
++ (TapSDKSuiteImageCache *)bundleImageCache {
+    static TapSDKSuiteImageCache *cache = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        // 默认图标为 @3x 的 150px 位图，单个约 90 KB
+        cache = [[TapSDKSuiteImageCache alloc] initWithName:@"bundle" costLimit:4 * 1024 * 1024];
+    });
+    return cache;
+}
+
 + (NSBundle *)getBundleWithName:(NSString *)bundleName aClass:(Class)aClass {
     NSBundle *localizableBundle;
     NSString *bundlePath = [[NSBundle mainBundle] pathForResource:bundleName ofType:@"bundle"];
@@ -34,6 +285,53 @@
     return localizableBundle;
 }
 
++ (void)setCurrentLanguage:(TapSDKSuiteLanguageType)langType {
+    if (langType <= TapSDKSuiteLanguageTypeAuto || langType > TAP_SUITE_TITLE_LANG_COUNT) {
+        langType = [self systemLanguage];
+    }
+    atomic_store(&TapSDKSuiteTitleLangIndex, langType - 1);
+}
+
++ (NSString *)localizedTitleForType:(TapSDKSuiteComponentType)type {
+    if (type < 0 || type >= TAP_SUITE_TITLE_TYPE_COUNT) {
+        return @"title";
+    }
+    long langIndex = atomic_load(&TapSDKSuiteTitleLangIndex);
+    if (langIndex < 0) {
+        // 仅在尚未设置语言时写入系统语言，不覆盖其他线程同时设置的语言
+        long expected = -1;
+        if (!atomic_compare_exchange_strong(&TapSDKSuiteTitleLangIndex, &expected, (long)[self systemLanguage] - 1)) {
+            langIndex = expected;
+        } else {
+            langIndex = atomic_load(&TapSDKSuiteTitleLangIndex);
+        }
+    }
+    return TapSDKSuiteTitleTable[langIndex][type];
+}
+
++ (TapSDKSuiteLanguageType)systemLanguage {
+    NSString *language = [NSLocale preferredLanguages].firstObject;
+    if ([language hasPrefix:@"zh"]) {
+        if ([language containsString:@"Hant"] || [language containsString:@"TW"] || [language containsString:@"HK"] || [language containsString:@"MO"]) {
+            return TapSDKSuiteLanguageTypeZhHant;
+        }
+        return TapSDKSuiteLanguageTypeZhHans;
+    }
+    if ([language hasPrefix:@"ja"]) {
+        return TapSDKSuiteLanguageTypeJa;
+    }
+    if ([language hasPrefix:@"ko"]) {
+        return TapSDKSuiteLanguageTypeKo;
+    }
+    if ([language hasPrefix:@"th"]) {
+        return TapSDKSuiteLanguageTypeTh;
+    }
+    if ([language hasPrefix:@"id"]) {
+        return TapSDKSuiteLanguageTypeId;
+    }
+    return TapSDKSuiteLanguageTypeEn;
+}
+
 + (UIEdgeInsets)safeAreaInset:(UIView *)view {
     if (@available(iOS 11.0, *)) {
         return view.safeAreaInsets;
@@ -56,6 +354,25 @@
     return YES;
 }
 
++ (BOOL)shouldReduceAnimation {
+    switch ([TapSDKSuite shareInstance].animationMode) {
+        case TapSDKSuiteAnimationModeFull:
+            return NO;
+        case TapSDKSuiteAnimationModeReduced:
+            return YES;
+
+        default:
+            break;
+    }
+    if (UIAccessibilityIsReduceMotionEnabled() || [NSProcessInfo processInfo].lowPowerModeEnabled) {
+        return YES;
+    }
+    if (@available(iOS 11.0, *)) {
+        return [NSProcessInfo processInfo].thermalState >= NSProcessInfoThermalStateSerious;
+    }
+    return NO;
+}
+
 + (CGFloat)screenShortLength {
     return MIN([UIScreen mainScreen].bounds.size.width, [UIScreen mainScreen].bounds.size.height);
 }